@@ -0,0 +1,47 @@
+// Per-operator throughput of the math channel block kernel
+#include <stdio.h>
+#include <string.h>
+
+#include "channels_internal.h"
+#include "bench_time.h"
+
+#define BENCH_BLOCKS 2000000
+#define BENCH_SRC_LEN 4096 // Power of two, multiple of SAMPLES_PER_COLUMN
+
+static const char* OP_NAMES[] = { "add", "sub", "mul", "gain", "deriv", "integ" };
+
+int main() {
+    // Stream varying input so stateless operators cannot be hoisted
+    static sample_t a[BENCH_SRC_LEN];
+    static sample_t b[BENCH_SRC_LEN];
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < BENCH_SRC_LEN; i++) {
+        seed = seed * 1103515245 + 12345;
+        a[i] = (sample_t)(seed >> 16);
+        seed = seed * 1103515245 + 12345;
+        b[i] = (sample_t)(seed >> 16);
+    }
+
+    const MathOp ops[] = {
+        { MATH_ADD, 0 }, { MATH_SUB, 0 }, { MATH_MUL, 0 },
+        { MATH_GAIN, 384 }, { MATH_DERIV, 2 }, { MATH_INTEG, 6 }
+    };
+    uint32_t checksum = 0;
+    for (size_t op_idx = 0; op_idx < sizeof(ops) / sizeof(ops[0]); op_idx++) {
+        MathOpState state = { 0, false };
+        sample_t work[SAMPLES_PER_COLUMN];
+        double start = bench_seconds();
+        for (long blk = 0; blk < BENCH_BLOCKS; blk++) {
+            size_t offset = (blk * SAMPLES_PER_COLUMN) & (BENCH_SRC_LEN - 1);
+            memcpy(work, &a[offset], sizeof(work));
+            run_math_op(&ops[op_idx], &state, work, &b[offset], SAMPLES_PER_COLUMN);
+            for (size_t i = 0; i < SAMPLES_PER_COLUMN; i++) { checksum += (uint16_t)work[i]; }
+        }
+        double elapsed = bench_seconds() - start;
+        double samples = (double)BENCH_BLOCKS * SAMPLES_PER_COLUMN;
+        printf("%-6s %8.1f Msamples/s (%.2f ns/sample)\n", OP_NAMES[ops[op_idx].type],
+               samples / elapsed * 1.0e-6, elapsed / samples * 1.0e9);
+    }
+    printf("checksum %u\n", (unsigned)checksum);
+    return 0;
+}
@@ -0,0 +1,45 @@
+// Frame cost of a full graph redraw for the panel this binary was built for.
+// send_pixels is stubbed, so this times rasterization and counts the pixels
+// that would go over SPI.
+#include <stdio.h>
+#include <unistd.h>
+
+#include "graph.h"
+#include "stub_display.h"
+#include "bench_time.h"
+
+#define BENCH_FRAMES 500
+
+int main() {
+    // draw_graph logs every frame; keep the report on the real stdout only
+    FILE* report = fdopen(dup(fileno(stdout)), "w");
+    freopen("/dev/null", "w", stdout);
+
+    init_graph();
+    for (size_t t_idx = 0; t_idx < NUM_TRACES; t_idx++) {
+        for (xcoord_t x = 0; x < DISPLAY_WIDTH; x++) {
+            ycoord_t lo = (x * (t_idx + 3) + t_idx * 31) % (DISPLAY_HEIGHT - 8);
+            traces[t_idx][x] = TRACE_PACK(lo, lo + 1 + (x + t_idx) % 8);
+        }
+        set_trace_enable(t_idx, true);
+    }
+
+    stub_pixels_sent = 0;
+    double start = bench_seconds();
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        set_graph_window((GraphWindow){ 50, 50, 0, DISPLAY_WIDTH - 1,
+                                        DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 2 });
+        draw_graph();
+    }
+    double elapsed = bench_seconds() - start;
+
+    double pixels = (double)stub_pixels_sent / BENCH_FRAMES;
+    double bytes565 = pixels * 2;
+    double bytes444 = pixels * 3 / 2;
+    fprintf(report, "panel %dx%d (%d cols/strip): %.1f us/frame raster, "
+            "%.0f px/frame, %.0f B RGB565 (%.2f ms @26MHz), %.0f B RGB444 (%.2f ms @26MHz)\n",
+            DISPLAY_WIDTH, DISPLAY_HEIGHT, STRIP_COLS, elapsed / BENCH_FRAMES * 1.0e6,
+            pixels, bytes565, bytes565 * 8 / 26.0e3, bytes444, bytes444 * 8 / 26.0e3);
+    fclose(report);
+    return 0;
+}
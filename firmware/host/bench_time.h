@@ -0,0 +1,9 @@
+#pragma once
+
+#include <time.h>
+
+static inline double bench_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1.0e-9;
+}
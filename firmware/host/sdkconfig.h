@@ -0,0 +1,4 @@
+#pragma once
+
+// Host builds have no menuconfig; CONFIG_* options come from the compiler
+// command line (see CMakeLists.txt).
@@ -0,0 +1,13 @@
+#include "ST7789.h"
+#include "stub_display.h"
+
+size_t stub_pixels_sent = 0;
+
+// Stand-in for the SPI driver: only counts what would go over the wire
+void send_pixels(xcoord_t xpos, ycoord_t ypos,
+                 xcoord_t width, ycoord_t height,
+                 color_t *data)
+{
+    (void)xpos; (void)ypos; (void)data;
+    stub_pixels_sent += (size_t)width * height;
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stddef.h>
+
+// Pixels passed to the stubbed send_pixels() since the last reset
+extern size_t stub_pixels_sent;
@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "channels.h"
+#include "channels_internal.h"
+#include "graph.h"
+
+static int failures = 0;
+
+static void check_samples(const char* name, const sample_t* got,
+                          const sample_t* expected, size_t n) {
+    if (memcmp(got, expected, n * sizeof(sample_t)) != 0) {
+        printf("FAIL %s: got", name);
+        for (size_t i = 0; i < n; i++) printf(" %d", got[i]);
+        printf(", expected");
+        for (size_t i = 0; i < n; i++) printf(" %d", expected[i]);
+        printf("\n");
+        failures++;
+    }
+}
+
+static void check(const char* name, bool ok) {
+    if (!ok) {
+        printf("FAIL %s\n", name);
+        failures++;
+    }
+}
+
+static void run(MathOp op, MathOpState* state, sample_t* x, const sample_t* b, size_t n) {
+    run_math_op(&op, state, x, b, n);
+}
+
+static void test_saturation() {
+    MathOpState state = { 0, false };
+    const sample_t b[] = { 10000, -10000, -32768, 1 };
+
+    sample_t add[] = { 30000, -30000, 0, 100 };
+    const sample_t add_exp[] = { INT16_MAX, INT16_MIN, INT16_MIN, 101 };
+    run((MathOp){ MATH_ADD, 0 }, &state, add, b, 4);
+    check_samples("add saturates", add, add_exp, 4);
+
+    sample_t sub[] = { -30000, 30000, 0, 100 };
+    const sample_t sub_exp[] = { INT16_MIN, INT16_MAX, INT16_MAX, 99 };
+    run((MathOp){ MATH_SUB, 0 }, &state, sub, b, 4);
+    check_samples("sub saturates", sub, sub_exp, 4);
+
+    const sample_t mb[] = { -32768, -32768, 16384, 0 };
+    sample_t mul[] = { -32768, 32767, 16384, 1234 };
+    const sample_t mul_exp[] = { INT16_MAX, -32767, 8192, 0 };
+    run((MathOp){ MATH_MUL, 0 }, &state, mul, mb, 4);
+    check_samples("mul saturates", mul, mul_exp, 4);
+}
+
+static void test_derivative() {
+    MathOpState state = { 0, false };
+    sample_t flat[] = { 20000, 20000, 20000, 20000 };
+    const sample_t flat_exp[] = { 0, 0, 0, 0 };
+    run((MathOp){ MATH_DERIV, 0 }, &state, flat, NULL, 4);
+    check_samples("deriv first sample is not a step", flat, flat_exp, 4);
+
+    // Continues from the previous block's last sample
+    sample_t ramp[] = { 20100, 20300, 20600, 20600 };
+    const sample_t ramp_exp[] = { 200, 400, 600, 0 };
+    run((MathOp){ MATH_DERIV, 1 }, &state, ramp, NULL, 4);
+    check_samples("deriv across blocks", ramp, ramp_exp, 4);
+
+    sample_t big[] = { -32768, 32767 };
+    const sample_t big_exp[] = { INT16_MIN, INT16_MAX };
+    run((MathOp){ MATH_DERIV, MATH_MAX_SHIFT }, &state, big, NULL, 2);
+    check_samples("deriv saturates", big, big_exp, 2);
+}
+
+static void test_integral() {
+    MathOpState state = { 0, false };
+    sample_t up[] = { 20000, 20000, 20000 };
+    const sample_t up_exp[] = { 20000, INT16_MAX, INT16_MAX };
+    run((MathOp){ MATH_INTEG, 0 }, &state, up, NULL, 3);
+    check_samples("integ clamps high", up, up_exp, 3);
+
+    // Clamped accumulator: the first negative sample moves the output at once
+    sample_t down[] = { -30000, -30000, -30000 };
+    const sample_t down_exp[] = { 2767, -27233, -INT16_MAX }; // Clamp is symmetric
+    run((MathOp){ MATH_INTEG, 0 }, &state, down, NULL, 3);
+    check_samples("integ clamps low", down, down_exp, 3);
+
+    MathOpState shifted = { 0, false };
+    sample_t full[20];
+    for (size_t i = 0; i < 20; i++) full[i] = INT16_MAX;
+    run((MathOp){ MATH_INTEG, 4 }, &shifted, full, NULL, 20);
+    check("integ shift reaches full scale", full[15] == INT16_MAX && full[19] == INT16_MAX);
+    check("integ shift scales", full[0] == INT16_MAX >> 4);
+    sample_t back[] = { -32767 };
+    run((MathOp){ MATH_INTEG, 4 }, &shifted, back, NULL, 1);
+    check("integ shift clamp", back[0] == ((INT16_MAX << 4) - 32767) >> 4);
+}
+
+static void test_validation() {
+    MathChannel ch = { 0, 1, 1, { { MATH_DERIV, 16 } } };
+    check("reject deriv shift 16", !set_math_channel(0, &ch));
+    ch.ops[0] = (MathOp){ MATH_DERIV, -1 };
+    check("reject deriv shift -1", !set_math_channel(0, &ch));
+    ch.ops[0] = (MathOp){ MATH_INTEG, 16 };
+    check("reject integ shift 16", !set_math_channel(0, &ch));
+    ch.ops[0] = (MathOp){ MATH_INTEG, -1 };
+    check("reject integ shift -1", !set_math_channel(0, &ch));
+    ch.ops[0] = (MathOp){ (math_op_type_t)42, 0 };
+    check("reject unknown operator", !set_math_channel(0, &ch));
+    ch.ops[0] = (MathOp){ MATH_ADD, 0 };
+    ch.src_b = NUM_INPUTS;
+    check("reject bad source", !set_math_channel(0, &ch));
+    check("reject bad channel", !set_math_channel(NUM_MATH_CHANNELS, &ch));
+    ch.src_b = 1;
+    ch.ops[0] = (MathOp){ MATH_DERIV, MATH_MAX_SHIFT };
+    check("accept deriv shift 15", set_math_channel(0, &ch));
+    clear_math_channel(0);
+}
+
+static bool trace_all_empty(size_t t_idx) {
+    for (xcoord_t x = 0; x < DISPLAY_WIDTH; x++) {
+        if (traces[t_idx][x] != TRACE_EMPTY) return false;
+    }
+    return true;
+}
+
+static void test_trace_output() {
+    const xcoord_t last = DISPLAY_WIDTH - 1;
+    const size_t m_idx = 1;
+    const size_t t_idx = NUM_INPUTS + m_idx;
+    sample_t a[SAMPLES_PER_COLUMN];
+    sample_t b[SAMPLES_PER_COLUMN];
+    for (size_t i = 0; i < SAMPLES_PER_COLUMN; i++) { a[i] = 16384; b[i] = 0; }
+    const sample_t* blocks[NUM_INPUTS] = { a, b };
+
+    check("traces start empty", trace_all_empty(t_idx));
+    MathChannel diff = { 0, 1, 1, { { MATH_SUB, 0 } } };
+    check("define A-B", set_math_channel(m_idx, &diff));
+    push_sample_block(blocks);
+    // With B = 0, A-B decimates to the same column as input A
+    check("math output in traces[NUM_INPUTS + m]", traces[t_idx][last] == traces[0][last]);
+    check("math output not in other slots", traces[NUM_INPUTS][last] == TRACE_EMPTY);
+    check("history before enable is empty", traces[t_idx][last - 1] == TRACE_EMPTY);
+
+    clear_math_channel(m_idx);
+    MathChannel sum = { 0, 1, 1, { { MATH_ADD, 0 } } };
+    check("redefine", set_math_channel(m_idx, &sum));
+    check("redefine clears history", trace_all_empty(t_idx));
+    clear_math_channel(m_idx);
+}
+
+int main() {
+    init_graph();
+    init_channels();
+
+    test_saturation();
+    test_derivative();
+    test_integral();
+    test_validation();
+    test_trace_output();
+
+    if (failures == 0) printf("channels: all checks passed\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "pixel_format.h"
+#include "ST7789.h"
+
+static int failures = 0;
+
+static void check_bytes(const char* name, const color_t* src, size_t n,
+                        const uint8_t* expected, size_t expected_len) {
+    uint8_t out[16];
+    memset(out, 0xAA, sizeof(out));
+    size_t len = pack_rgb444(out, src, n);
+    if (len != expected_len || memcmp(out, expected, expected_len) != 0) {
+        printf("FAIL %s: got %zu bytes:", name, len);
+        for (size_t i = 0; i < len; i++) printf(" %02X", out[i]);
+        printf("\n");
+        failures++;
+    }
+}
+
+static void check_rgb444(const char* name, color_t c, uint16_t expected) {
+    uint16_t got = rgb444(c);
+    if (got != expected) {
+        printf("FAIL %s: rgb444 = %03X, expected %03X\n", name, got, expected);
+        failures++;
+    }
+}
+
+int main() {
+    check_rgb444("black", ST77XX_WIRE(ST77XX_BLACK), 0x000);
+    check_rgb444("white", ST77XX_WIRE(ST77XX_WHITE), 0xFFF);
+    check_rgb444("red", ST77XX_WIRE(ST77XX_RED), 0xF00);
+    check_rgb444("green", ST77XX_WIRE(ST77XX_GREEN), 0x0F0);
+    check_rgb444("blue", ST77XX_WIRE(ST77XX_BLUE), 0x00F);
+    check_rgb444("orange", ST77XX_WIRE(ST77XX_ORANGE), 0xF80);
+
+    // Even count: R1G1 B1R2 G2B2 per pair
+    const color_t even[] = {
+        ST77XX_WIRE(ST77XX_RED), ST77XX_WIRE(ST77XX_GREEN),
+        ST77XX_WIRE(ST77XX_BLUE), ST77XX_WIRE(ST77XX_WHITE)
+    };
+    const uint8_t even_bytes[] = { 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFF };
+    check_bytes("even", even, 4, even_bytes, sizeof(even_bytes));
+
+    // Odd count: trailing pixel padded to two bytes
+    const color_t odd[] = {
+        ST77XX_WIRE(ST77XX_BLUE), ST77XX_WIRE(ST77XX_RED),
+        ST77XX_WIRE(ST77XX_ORANGE)
+    };
+    const uint8_t odd_bytes[] = { 0x00, 0xFF, 0x00, 0xF8, 0x00 };
+    check_bytes("odd", odd, 3, odd_bytes, sizeof(odd_bytes));
+
+    const color_t single[] = { ST77XX_WIRE(ST77XX_GREEN) };
+    const uint8_t single_bytes[] = { 0x0F, 0x00 };
+    check_bytes("single", single, 1, single_bytes, sizeof(single_bytes));
+
+    // A full strip is three quarters of its RGB565 size
+    static color_t strip[MAX_PIXEL_TRANSACTION];
+    static uint8_t packed[MAX_PIXEL_TRANSACTION * 2];
+    size_t len = pack_rgb444(packed, strip, MAX_PIXEL_TRANSACTION);
+    if (len * 4 != MAX_PIXEL_TRANSACTION * sizeof(color_t) * 3) {
+        printf("FAIL strip: %zu bytes for %d pixels\n", len, MAX_PIXEL_TRANSACTION);
+        failures++;
+    }
+
+    if (failures == 0) printf("pixel_format: all checks passed\n");
+    return failures ? 1 : 0;
+}
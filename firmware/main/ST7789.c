@@ -28,12 +28,22 @@ typedef struct {
 #define DELAY_FLAG 0x80
 #define END_OF_CMDS 0xFF
 
+#ifdef CONFIG_LCD_COLOR_12BIT
+#define DEFAULT_PIXEL_FORMAT PIXEL_FORMAT_RGB444
+#define DEFAULT_COLMOD COLMOD_12BIT
+#else
+#define DEFAULT_PIXEL_FORMAT PIXEL_FORMAT_RGB565
+#define DEFAULT_COLMOD COLMOD_16BIT
+#endif
+
+static pixel_format_t pixel_format = DEFAULT_PIXEL_FORMAT;
+
 //Place data into DRAM. Constant data gets placed into DROM by default, which is not accessible by DMA.
 DRAM_ATTR static const lcd_init_cmd_t lcd_init_cmds[]={
     /* Memory Data Access Control, MY=MV=1, MX=ML=MH=0, RGB=0 */
     {MADCTL, {MADCTL_MY | MADCTL_MV}, 1},
-    /* Interface Pixel Format, 16bits/pixel for RGB/MCU interface */
-    {COLMOD, {COLMOD_16BIT}, 1},
+    /* Interface Pixel Format, 16 or 12 bits/pixel for RGB/MCU interface */
+    {COLMOD, {DEFAULT_COLMOD}, 1},
     /* Porch Setting */
     {PORCTRL, {0x0c, 0x0c, PORCTRL_DISABLE, 0x33, 0x33}, 5},
     /* Gate Control, Vgh=13.65V, Vgl=-10.43V */
@@ -173,10 +183,10 @@ static void init_st7789()
 }
 
 static spi_transaction_t pixel_trans[6];
-uint16_t* pixel_tx_buffer;
+color_t* pixel_tx_buffer;
 
 static void init_pixel_trans() {
-    pixel_tx_buffer = malloc(MAX_PIXEL_TRANSACTION * sizeof(uint16_t));
+    pixel_tx_buffer = malloc(MAX_PIXEL_TRANSACTION * sizeof(color_t));
     memset(pixel_trans, 0, sizeof(spi_transaction_t) * 6);
     for (int t_idx=0; t_idx<6; t_idx++) {
         if ((t_idx&1)==0) {
@@ -225,7 +235,7 @@ static void finish_pixel_transaction()
 static void send_pixels_single(
         uint16_t xpos, uint16_t ypos, 
         uint16_t width, uint16_t height, 
-        uint16_t *data)
+        color_t *data)
 {
     assert(width * height <= MAX_PIXEL_TRANSACTION);
 
@@ -233,8 +243,10 @@ static void send_pixels_single(
     finish_pixel_transaction();
 
     // Set window dimensions
-    uint16_t xend = xpos + width;
-    uint16_t yend = ypos + height;
+    xpos += DISPLAY_X_OFFSET;
+    ypos += DISPLAY_Y_OFFSET;
+    uint16_t xend = xpos + width - 1;     //CASET/RASET ends are inclusive
+    uint16_t yend = ypos + height - 1;
     pixel_trans[1].tx_data[0] = (xpos >> 8);    //Start Col High
     pixel_trans[1].tx_data[1] = (xpos & 0xFF);  //Start Col Low
     pixel_trans[1].tx_data[2] = (xend >> 8);    //End Col High
@@ -244,9 +256,14 @@ static void send_pixels_single(
     pixel_trans[3].tx_data[2] = (yend >> 8);    //End page high
     pixel_trans[3].tx_data[3] = (yend & 0xFF);  //End page low
     
-    // Setup the TX buffer
-    size_t pixel_bytes = width * height * sizeof(uint16_t);
-    memcpy((void*)pixel_tx_buffer, (void*)data, pixel_bytes);
+    // Setup the TX buffer; RGB565 data is already in wire order
+    size_t pixel_bytes;
+    if (pixel_format == PIXEL_FORMAT_RGB444) {
+        pixel_bytes = pack_rgb444((uint8_t*)pixel_tx_buffer, data, width * height);
+    } else {
+        pixel_bytes = width * height * sizeof(color_t);
+        memcpy((void*)pixel_tx_buffer, (void*)data, pixel_bytes);
+    }
     pixel_trans[5].length    = pixel_bytes * 8; //bits
 
     //Queue all transactions.
@@ -257,6 +274,23 @@ static void send_pixels_single(
     pixel_trans_active = true;
 }
 
+void set_pixel_format(pixel_format_t format)
+{
+    if (format == pixel_format) { return; }
+
+    // COLMOD goes out in polling mode, so drain any queued pixel data first
+    finish_pixel_transaction();
+    uint8_t colmod = (format == PIXEL_FORMAT_RGB444) ? COLMOD_12BIT : COLMOD_16BIT;
+    lcd_cmd(COLMOD);
+    lcd_data(&colmod, 1);
+    pixel_format = format;
+}
+
+pixel_format_t get_pixel_format()
+{
+    return pixel_format;
+}
+
 static inline int min(int a, int b) { return (a < b) ? a : b; }
 
 void send_pixels(xcoord_t xpos, ycoord_t ypos, 
@@ -279,8 +313,8 @@ void send_pixels(xcoord_t xpos, ycoord_t ypos,
 
 void blank_screen()
 {
-    size_t buffer_size = sizeof(uint16_t) * DISPLAY_WIDTH * MAX_LINES;
-    uint16_t* buffer = malloc(buffer_size);
+    size_t buffer_size = sizeof(color_t) * DISPLAY_WIDTH * MAX_LINES;
+    color_t* buffer = malloc(buffer_size);
     memset(buffer, 0, buffer_size);
     int curr_line = 0;
     while (curr_line < DISPLAY_HEIGHT) {
@@ -0,0 +1,167 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "channels.h"
+#include "channels_internal.h"
+#include "graph.h"
+
+typedef struct MathState {
+    bool active;
+    MathChannel def;
+    MathOpState op_state[MAX_MATH_OPS];
+} MathState;
+
+static MathState math_channels[NUM_MATH_CHANNELS];
+static ycoord_t last_y[NUM_TRACES];
+static bool have_last[NUM_TRACES];
+
+void init_channels() {
+    memset(math_channels, 0, sizeof(math_channels));
+    memset(have_last, 0, sizeof(have_last));
+}
+
+bool set_math_channel(size_t math_idx, const MathChannel* channel) {
+    if (math_idx >= NUM_MATH_CHANNELS) return false;
+    if (channel->n_ops > MAX_MATH_OPS) return false;
+    if (channel->src_a >= NUM_INPUTS || channel->src_b >= NUM_INPUTS) return false;
+    for (uint8_t op_idx = 0; op_idx < channel->n_ops; op_idx++) {
+        const MathOp* op = &channel->ops[op_idx];
+        switch (op->type) {
+        case MATH_ADD:
+        case MATH_SUB:
+        case MATH_MUL:
+        case MATH_GAIN:
+            break;
+        case MATH_DERIV:
+        case MATH_INTEG:
+            if (op->param < 0 || op->param > MATH_MAX_SHIFT) return false;
+            break;
+        default:
+            return false;
+        }
+    }
+
+    MathState* st = &math_channels[math_idx];
+    memcpy(&st->def, channel, sizeof(MathChannel));
+    memset(st->op_state, 0, sizeof(st->op_state));
+    st->active = true;
+    // Start from an empty history so stale heap or an old definition's
+    // waveform never shows before the new channel fills the screen
+    size_t t_idx = NUM_INPUTS + math_idx;
+    for (xcoord_t x = 0; x < DISPLAY_WIDTH; x++) {
+        traces[t_idx][x] = TRACE_EMPTY;
+    }
+    have_last[t_idx] = false;
+    set_trace_enable(t_idx, true);
+    return true;
+}
+
+void clear_math_channel(size_t math_idx) {
+    if (math_idx >= NUM_MATH_CHANNELS) return;
+    math_channels[math_idx].active = false;
+    set_trace_enable(NUM_INPUTS + math_idx, false);
+}
+
+static inline sample_t sat16(int32_t v) {
+    if (v > INT16_MAX) return INT16_MAX;
+    if (v < INT16_MIN) return INT16_MIN;
+    return (sample_t)v;
+}
+
+// Apply one operator to a whole block; the operator is dispatched once per
+// block rather than once per sample.
+void run_math_op(const MathOp* op, MathOpState* state,
+                 sample_t* x, const sample_t* b, size_t n) {
+    switch (op->type) {
+    case MATH_ADD:
+        for (size_t i = 0; i < n; i++) { x[i] = sat16((int32_t)x[i] + b[i]); }
+        break;
+    case MATH_SUB:
+        for (size_t i = 0; i < n; i++) { x[i] = sat16((int32_t)x[i] - b[i]); }
+        break;
+    case MATH_MUL:
+        for (size_t i = 0; i < n; i++) { x[i] = sat16(((int32_t)x[i] * b[i]) >> 15); }
+        break;
+    case MATH_GAIN:
+        for (size_t i = 0; i < n; i++) { x[i] = sat16(((int32_t)x[i] * op->param) >> 8); }
+        break;
+    case MATH_DERIV: {
+        if (!state->primed && n > 0) {
+            state->value = x[0];
+            state->primed = true;
+        }
+        int32_t prev = state->value;
+        int32_t gain = 1 << op->param;
+        for (size_t i = 0; i < n; i++) {
+            int32_t d = (int32_t)x[i] - prev;
+            prev = x[i];
+            x[i] = sat16(d * gain);
+        }
+        state->value = prev;
+        break;
+    }
+    case MATH_INTEG: {
+        int32_t acc = state->value;
+        const int32_t hi = (int32_t)INT16_MAX << op->param;
+        const int32_t lo = -hi;
+        for (size_t i = 0; i < n; i++) {
+            acc += x[i];
+            if (acc > hi) acc = hi;
+            if (acc < lo) acc = lo;
+            x[i] = sat16(acc >> op->param);
+        }
+        state->value = acc;
+        break;
+    }
+    }
+}
+
+static inline ycoord_t sample_to_y(sample_t s) {
+    const int32_t half = (DISPLAY_HEIGHT - 1) / 2;
+    return (ycoord_t)(half + (((int32_t)s * half) >> 15));
+}
+
+// Reduce a block to a single-column low/high envelope, joined to the
+// previous column so steep edges stay connected.
+static trace_t decimate(size_t trace_idx, const sample_t* block, size_t n) {
+    ycoord_t lo = sample_to_y(block[0]);
+    ycoord_t hi = lo;
+    if (have_last[trace_idx]) {
+        ycoord_t y = last_y[trace_idx];
+        if (y < lo) lo = y;
+        if (y > hi) hi = y;
+    }
+    for (size_t i = 1; i < n; i++) {
+        ycoord_t y = sample_to_y(block[i]);
+        if (y < lo) lo = y;
+        if (y > hi) hi = y;
+    }
+    last_y[trace_idx] = sample_to_y(block[n - 1]);
+    have_last[trace_idx] = true;
+    return TRACE_PACK(lo, hi);
+}
+
+void push_sample_block(const sample_t* blocks[NUM_INPUTS]) {
+    const xcoord_t last = DISPLAY_WIDTH - 1;
+    for (size_t t_idx = 0; t_idx < NUM_TRACES; t_idx++) {
+        memmove(&traces[t_idx][0], &traces[t_idx][1], sizeof(trace_t) * last);
+    }
+
+    for (size_t in_idx = 0; in_idx < NUM_INPUTS; in_idx++) {
+        traces[in_idx][last] = decimate(in_idx, blocks[in_idx], SAMPLES_PER_COLUMN);
+    }
+
+    sample_t work[SAMPLES_PER_COLUMN];
+    for (size_t m_idx = 0; m_idx < NUM_MATH_CHANNELS; m_idx++) {
+        MathState* st = &math_channels[m_idx];
+        if (!st->active) continue;
+        memcpy(work, blocks[st->def.src_a], sizeof(work));
+        const sample_t* b = blocks[st->def.src_b];
+        for (uint8_t op_idx = 0; op_idx < st->def.n_ops; op_idx++) {
+            run_math_op(&st->def.ops[op_idx], &st->op_state[op_idx],
+                        work, b, SAMPLES_PER_COLUMN);
+        }
+        size_t t_idx = NUM_INPUTS + m_idx;
+        traces[t_idx][last] = decimate(t_idx, work, SAMPLES_PER_COLUMN);
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// Block kernel behind the math channels. Not part of the channel API;
+// exposed for host tests and benchmarks.
+
+#include "channels.h"
+
+typedef struct MathOpState {
+    int32_t value; // Previous sample (DERIV) or sum (INTEG)
+    bool primed;   // DERIV has seen a sample to difference against
+} MathOpState;
+
+// Apply op in place to the n samples in x; b is input B for ADD/SUB/MUL
+void run_math_op(const MathOp* op, MathOpState* state,
+                 sample_t* x, const sample_t* b, size_t n);
@@ -12,10 +12,12 @@ trace_t* traces[NUM_TRACES];
 static trace_t* trace_window;
 static trace_t* dirty_window;
 static bool trace_en[NUM_TRACES];
-static color_t TRACE_COLORS[6] = {
-    ST77XX_RED, ST77XX_GREEN, ST77XX_BLUE,
-    ST77XX_CYAN, ST77XX_ORANGE, ST77XX_MAGENTA
+static const color_t TRACE_COLORS[6] = {
+    ST77XX_WIRE(ST77XX_RED), ST77XX_WIRE(ST77XX_GREEN), ST77XX_WIRE(ST77XX_BLUE),
+    ST77XX_WIRE(ST77XX_CYAN), ST77XX_WIRE(ST77XX_ORANGE), ST77XX_WIRE(ST77XX_MAGENTA)
 };
+static const color_t AXIS_COLOR = ST77XX_WIRE(ST77XX_WHITE);
+static const color_t GRID_COLOR = ST77XX_WIRE(ST77XX_YELLOW);
 
 static color_t* paint_buffer;
 
@@ -26,11 +28,14 @@ void set_trace_enable(size_t trace_idx, bool enable) {
     trace_en[trace_idx] = enable;
 }
 void init_graph() {
-    paint_buffer = malloc(sizeof(uint16_t) * MAX_PIXEL_TRANSACTION);
-    trace_window = malloc(sizeof(uint16_t) * DISPLAY_WIDTH);
-    dirty_window = malloc(sizeof(uint16_t) * DISPLAY_WIDTH);
+    paint_buffer = malloc(sizeof(color_t) * MAX_PIXEL_TRANSACTION);
+    trace_window = malloc(sizeof(trace_t) * DISPLAY_WIDTH);
+    dirty_window = malloc(sizeof(trace_t) * DISPLAY_WIDTH);
     for (size_t trace_idx = 0; trace_idx < NUM_TRACES; trace_idx++) {
-        traces[trace_idx] = malloc(sizeof(uint16_t) * DISPLAY_WIDTH);
+        traces[trace_idx] = malloc(sizeof(trace_t) * DISPLAY_WIDTH);
+        for (xcoord_t x = 0; x < DISPLAY_WIDTH; x++) {
+            traces[trace_idx][x] = TRACE_EMPTY;
+        }
         trace_en[trace_idx] = false;
     }
     activeWindow.gridx = 50;
@@ -47,9 +52,12 @@ void set_graph_window(GraphWindow window) {
     drawFull = true;
 }
 
-static void paint_graph_area(int xpos, int ypos, int w, int h) {
+// Rasterize one rectangle of the graph. Always inlined into the two wrappers
+// below so the full-strip copy can fold its geometry into constants.
+static inline __attribute__((always_inline))
+void paint_graph_area_impl(int xpos, int ypos, int w, int h) {
     const size_t n = w * h;
-    memset(paint_buffer, 0, sizeof(uint16_t) * n);
+    memset(paint_buffer, 0, sizeof(color_t) * n);
     int xend = xpos + w - 1;
     int yend = ypos + h - 1;
 
@@ -57,7 +65,7 @@ static void paint_graph_area(int xpos, int ypos, int w, int h) {
     while (gx > xpos && gx >= activeWindow.gridx) { gx -= activeWindow.gridx; }
     while (gx <= xend) {
         if (gx >= xpos) {
-            color_t color = (gx == activeWindow.midx) ? ST77XX_WHITE : ST77XX_YELLOW;
+            color_t color = (gx == activeWindow.midx) ? AXIS_COLOR : GRID_COLOR;
             for (ycoord_t y = 0; y < h; y++) {
                 paint_buffer[y * w + gx - xpos] = color;
             }
@@ -69,7 +77,7 @@ static void paint_graph_area(int xpos, int ypos, int w, int h) {
     while (gy > ypos && gy >= activeWindow.gridy) { gy -= activeWindow.gridy; }
     while (gy <= yend) {
         if (gy >= ypos) {
-            color_t color = (gy == activeWindow.midy) ? ST77XX_WHITE : ST77XX_YELLOW;
+            color_t color = (gy == activeWindow.midy) ? AXIS_COLOR : GRID_COLOR;
             for (xcoord_t x = 0; x < w; x++) {
                 paint_buffer[(gy - ypos) * w + x] = color;
             }
@@ -81,8 +89,8 @@ static void paint_graph_area(int xpos, int ypos, int w, int h) {
         if (!trace_en[t_idx]) continue;
         for (int x = 0; x < w; x++) {
             trace_t yt = traces[t_idx][x + xpos];
-            int ylo = (yt & 0xFF) - ypos;
-            int yhi = (yt >> 8) - ypos;
+            int ylo = TRACE_LO(yt) - ypos;
+            int yhi = TRACE_HI(yt) - ypos;
             for (int y = ylo; y <= yhi; y++) {
                 if (y >= h) continue;
                 //printf("Coloring element %d at (%d, %d) with %x\n",
@@ -95,17 +103,27 @@ static void paint_graph_area(int xpos, int ypos, int w, int h) {
     send_pixels(xpos, ypos, w, h, paint_buffer);
 }
 
+static __attribute__((noinline))
+void paint_graph_area(int xpos, int ypos, int w, int h) {
+    paint_graph_area_impl(xpos, ypos, w, h);
+}
+
+// Full-height strip of STRIP_COLS columns, specialized for the panel
+static void paint_full_strip(int xpos) {
+    paint_graph_area_impl(xpos, 0, STRIP_COLS, DISPLAY_HEIGHT);
+}
+
 static trace_t widen(trace_t old, trace_t trace) {
-    ycoord_t old_lo = (old & 0xFF);
-    ycoord_t trace_lo = (trace & 0xFF);
+    ycoord_t old_lo = TRACE_LO(old);
+    ycoord_t trace_lo = TRACE_LO(trace);
     ycoord_t new_lo = (trace_lo < old_lo) ? trace_lo : old_lo;
-    ycoord_t old_hi = (old >> 8);
-    ycoord_t trace_hi = (trace >> 8);
+    ycoord_t old_hi = TRACE_HI(old);
+    ycoord_t trace_hi = TRACE_HI(trace);
     ycoord_t new_hi = (trace_hi > old_hi) ? trace_hi : old_hi;
-    return (new_hi << 8) | new_lo;
+    return TRACE_PACK(new_lo, new_hi);
 }
 
-static void update_trace_window(uint16_t* window) {
+static void update_trace_window(trace_t* window) {
     memcpy(window, traces[0], sizeof(trace_t) * DISPLAY_WIDTH);
     for (xcoord_t xpos = activeWindow.left; xpos <= activeWindow.right; xpos++) {
         for (size_t t_idx = 1; t_idx < NUM_TRACES; t_idx++) {
@@ -115,18 +133,20 @@ static void update_trace_window(uint16_t* window) {
 }
 
 static void draw_graph_full() {
-    const xcoord_t MAX_COL = MAX_PIXEL_TRANSACTION / DISPLAY_HEIGHT;
-    for (xcoord_t xpos = activeWindow.left; xpos <= activeWindow.right; xpos += MAX_COL) {
-        xcoord_t n_col = (xpos + MAX_COL > activeWindow.right) ? (activeWindow.right - xpos + 1) : MAX_COL;
-        paint_graph_area(xpos, 0, n_col, DISPLAY_HEIGHT);
+    xcoord_t xpos = activeWindow.left;
+    for (; xpos + STRIP_COLS <= activeWindow.right + 1; xpos += STRIP_COLS) {
+        paint_full_strip(xpos);
+    }
+    if (xpos <= activeWindow.right) {
+        paint_graph_area(xpos, 0, activeWindow.right - xpos + 1, DISPLAY_HEIGHT);
     }
     update_trace_window(dirty_window);
     drawFull = false;
 }
 
 static ycoord_t theight(trace_t t) {
-    ycoord_t tlo = t & 0xFF;
-    ycoord_t thi = t >> 8;
+    ycoord_t tlo = TRACE_LO(t);
+    ycoord_t thi = TRACE_HI(t);
     return thi - tlo + 1;
 }
 
@@ -141,7 +161,7 @@ static void draw_graph_partial() {
         update = widen(update, trace_window[xpos]);
         while (w * theight(update) < MAX_PIXEL_TRANSACTION) {
             h = theight(update);
-            ypos = update & 0xFF;
+            ypos = TRACE_LO(update);
             if (xpos + (w++) > activeWindow.right) break;
             update = widen(update, dirty_window[xpos + w - 1]);
             update = widen(update, trace_window[xpos + w - 1]);
@@ -25,6 +25,7 @@
 #define MADCTL 0x36
 #define COLMOD 0x3A
 #define COLMOD_16BIT 0x55
+#define COLMOD_12BIT 0x53
 #define PORCTRL 0xB2
 #define PORCTRL_DISABLE 0x00
 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "graph.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define NUM_INPUTS 2
+#define NUM_MATH_CHANNELS (NUM_TRACES - NUM_INPUTS)
+#define SAMPLES_PER_COLUMN 8
+#define MAX_MATH_OPS 4
+#define MATH_MAX_SHIFT 15 // Largest DERIV/INTEG param that cannot overflow
+
+typedef int16_t sample_t; // Q15 fixed point, full scale = +/-1
+
+// Operators applied in order to the running block, which starts as input A.
+// param: MATH_MUL/ADD/SUB ignore it, MATH_GAIN is a Q8 gain (256 = 1.0),
+// MATH_DERIV is a left shift and MATH_INTEG is a right shift of the result,
+// both limited to 0..MATH_MAX_SHIFT.
+typedef enum {
+    MATH_ADD,   // x + B
+    MATH_SUB,   // x - B
+    MATH_MUL,   // x * B
+    MATH_GAIN,  // x * param / 256
+    MATH_DERIV, // (x[n] - x[n-1]) << param
+    MATH_INTEG  // sum(x) >> param
+} math_op_type_t;
+
+typedef struct MathOp {
+    math_op_type_t type;
+    int16_t param;
+} MathOp;
+
+typedef struct MathChannel {
+    uint8_t src_a;
+    uint8_t src_b;
+    uint8_t n_ops;
+    MathOp ops[MAX_MATH_OPS];
+} MathChannel;
+
+void init_channels();
+bool set_math_channel(size_t math_idx, const MathChannel* channel);
+void clear_math_channel(size_t math_idx);
+
+// Push one column's worth of raw samples (SAMPLES_PER_COLUMN per input).
+// Scrolls the traces left and decimates inputs and math channels into the
+// last column.
+void push_sample_block(const sample_t* blocks[NUM_INPUTS]);
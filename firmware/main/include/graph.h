@@ -7,7 +7,21 @@
 #define NUM_TRACES 6
 
 typedef uint8_t grid_t;
-typedef uint16_t trace_t; // Two bytes for low/hi on y axis
+// Packed low/high y pair; twice the width of ycoord_t
+#if DISPLAY_HEIGHT < 256
+typedef uint16_t trace_t;
+#define TRACE_SHIFT 8
+#else
+typedef uint32_t trace_t;
+#define TRACE_SHIFT 16
+#endif
+#define TRACE_MASK (((trace_t)1 << TRACE_SHIFT) - 1)
+#define TRACE_LO(t) ((ycoord_t)((t) & TRACE_MASK))
+#define TRACE_HI(t) ((ycoord_t)((t) >> TRACE_SHIFT))
+#define TRACE_PACK(lo, hi) (((trace_t)(hi) << TRACE_SHIFT) | (trace_t)(lo))
+// Column with no data: low above high, so it paints nothing and widen()
+// leaves the other operand unchanged
+#define TRACE_EMPTY TRACE_PACK(TRACE_MASK, 0)
 
 extern trace_t* traces[NUM_TRACES];
 
@@ -0,0 +1,46 @@
+#pragma once
+
+// Must come first: the panel choice below comes from menuconfig, and every
+// translation unit has to see the same geometry whatever it included before.
+#include "sdkconfig.h"
+#include <stdint.h>
+
+// Panel geometry, selected at build time. Everything downstream (strip
+// sizes, loop bounds, coordinate and trace types) is derived from here.
+// Offsets are in landscape (MADCTL MY|MV) coordinates, from the 240x320
+// controller RAM to the visible glass.
+#if defined(CONFIG_LCD_PANEL_240X240)
+#define DISPLAY_WIDTH 240
+#define DISPLAY_HEIGHT 240
+#define DISPLAY_X_OFFSET 80
+#define DISPLAY_Y_OFFSET 0
+#elif defined(CONFIG_LCD_PANEL_320X170)
+#define DISPLAY_WIDTH 320
+#define DISPLAY_HEIGHT 170
+#define DISPLAY_X_OFFSET 0
+#define DISPLAY_Y_OFFSET 35
+#elif defined(CONFIG_LCD_PANEL_280X240)
+#define DISPLAY_WIDTH 280
+#define DISPLAY_HEIGHT 240
+#define DISPLAY_X_OFFSET 20
+#define DISPLAY_Y_OFFSET 0
+#else // 320x240
+#define DISPLAY_WIDTH 320
+#define DISPLAY_HEIGHT 240
+#define DISPLAY_X_OFFSET 0
+#define DISPLAY_Y_OFFSET 0
+#endif
+
+#define MAX_LINES 2
+#define MAX_PIXEL_TRANSACTION (MAX_LINES*DISPLAY_WIDTH)
+
+// Columns per full-height strip when redrawing the whole graph
+#define STRIP_COLS (MAX_PIXEL_TRANSACTION / DISPLAY_HEIGHT)
+_Static_assert(STRIP_COLS >= 1, "MAX_PIXEL_TRANSACTION must fit a full-height column");
+
+typedef uint16_t xcoord_t;
+#if DISPLAY_HEIGHT < 256
+typedef uint8_t ycoord_t;
+#else
+typedef uint16_t ycoord_t;
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint16_t color_t;  // Color = R5G6B5 encoded, wire (big-endian) byte order
+
+// Pixel formats supported on the wire. RGB565 sends color_t buffers as-is;
+// RGB444 packs two pixels into three bytes (COLMOD 12-bit), cutting the
+// bytes sent per frame by 25% at the cost of color depth.
+typedef enum {
+    PIXEL_FORMAT_RGB565,
+    PIXEL_FORMAT_RGB444
+} pixel_format_t;
+
+// Convert a host-order 565 color to wire order. Use on constants so the swap
+// folds at compile time instead of being done per pixel.
+#define ST77XX_WIRE(c) ((color_t)((((c) & 0xFF) << 8) | (((c) >> 8) & 0xFF)))
+
+// Convert a wire-order 565 color to 12-bit 444 (R in bits 11:8).
+static inline uint16_t rgb444(color_t c)
+{
+    uint16_t h = ST77XX_WIRE(c);    //Back to host order
+    return ((h >> 4) & 0xF00) | ((h >> 3) & 0x0F0) | ((h >> 1) & 0x00F);
+}
+
+// Pack n pixels into dst as RGB444, two pixels per three bytes. An odd
+// trailing pixel is padded to two bytes. Returns the number of bytes written.
+size_t pack_rgb444(uint8_t *dst, const color_t *src, size_t n);
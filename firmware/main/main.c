@@ -12,6 +12,7 @@
 
 #include "ST7789.h"
 #include "graph.h"
+#include "channels.h"
 #include "test_signal.h"
 #include "esp_task_wdt.h"
 
@@ -28,6 +29,8 @@ void app_main(void)
     init_graph();
     printf("Graph initialized");
 
+    init_channels();
+
     gpio_reset_pin(BLINK_GPIO);
     gpio_set_direction(BLINK_GPIO, GPIO_MODE_OUTPUT);
 
@@ -0,0 +1,20 @@
+#include "pixel_format.h"
+
+size_t pack_rgb444(uint8_t *dst, const color_t *src, size_t n)
+{
+    uint8_t *out = dst;
+    size_t i = 0;
+    for (; i + 1 < n; i += 2) {
+        uint16_t p0 = rgb444(src[i]);
+        uint16_t p1 = rgb444(src[i + 1]);
+        *out++ = p0 >> 4;
+        *out++ = ((p0 & 0x0F) << 4) | (p1 >> 8);
+        *out++ = p1 & 0xFF;
+    }
+    if (i < n) {
+        uint16_t p0 = rgb444(src[i]);
+        *out++ = p0 >> 4;
+        *out++ = (p0 & 0x0F) << 4;
+    }
+    return out - dst;
+}
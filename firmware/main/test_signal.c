@@ -1,5 +1,6 @@
 #include "test_signal.h"
 #include "graph.h"
+#include "channels.h"
 #include "esp_timer.h"
 #include "math.h"
 #include <string.h>
@@ -15,25 +16,45 @@ float test_y(float x, float t) {
     return 2 * amp * z;
 }
 
+static float fb = 0.005;
+
+// Columns after which both test waveforms repeat (LCM of 1/fx and 1/fb)
+#define TEST_PERIOD_COLS 200
+
 bool first = true;
+static uint32_t test_col = 0;
+static float start_seconds = 0.0;
+
+static sample_t to_sample(float v) {
+    if (v > 1.0) v = 1.0;
+    if (v < -1.0) v = -1.0;
+    return (sample_t)(v * INT16_MAX);
+}
+
+// Generate one column of raw samples per input and feed the channel path
+static void push_test_column() {
+    sample_t a[SAMPLES_PER_COLUMN];
+    sample_t b[SAMPLES_PER_COLUMN];
+    for (size_t i = 0; i < SAMPLES_PER_COLUMN; i++) {
+        float x = test_col + (float)i / SAMPLES_PER_COLUMN;
+        a[i] = to_sample(test_y(x, start_seconds) / amp - 1.0);
+        b[i] = to_sample(0.5 * sin(2 * M_PI * fb * x));
+    }
+    test_col = (test_col + 1) % TEST_PERIOD_COLS;
+    const sample_t* blocks[NUM_INPUTS] = { a, b };
+    push_sample_block(blocks);
+}
 
 void update_test_signal() {
     if (!first) {
-        trace_t tmp = traces[0][0];
-        memcpy(&traces[0][0], &traces[0][1], sizeof(trace_t) * (DISPLAY_WIDTH-1));
-        traces[0][DISPLAY_WIDTH - 1] = tmp;
+        push_test_column();
         return;
     }
     //printf("Updating test signal");
     int64_t micros = esp_timer_get_time();
-    float seconds = ((float)micros) * 1.0e-6;
-    float prevy = test_y(-1.0, seconds);
+    start_seconds = ((float)micros) * 1.0e-6;
     for (xcoord_t x = 0; x < DISPLAY_WIDTH; x++) {
-        float y = test_y((float)x, seconds);
-        ycoord_t miny = round((y < prevy) ? y : prevy);
-        ycoord_t maxy = round((y > prevy) ? y : prevy);
-        traces[0][x] = ((trace_t)maxy << 8) | (trace_t)miny;
-        prevy = y;
+        push_test_column();
     }
     first = false;
 }
\ No newline at end of file